@@ -51,7 +51,7 @@ struct Build build(
     add_dependency(&lib, raylib);
     lib.root_dir = ".";
 
-    static char *exe_files[] = { "src/main.c" };
+    static char *exe_files[] = { "src/main.c", "src/replay.c" };
 
     static struct Build exe = {
         .kind = Build_Kind_Executable,
@@ -1,20 +1,54 @@
 #ifndef COMMON_H
 #define COMMON_H
 
+#include <stdint.h>
+
 #include "stdlib/allocators.h"
 
+// Scenes read input through `Game_Context` instead of polling raylib directly,
+// so the host can record it or feed it back from a replay log.
+enum Game_Key {
+    Game_Key_Space,
+    Game_Key_R,
+    Game_Key_Tab,
+    Game_Key_F5,
+    Game_Key_COUNT,
+};
+
+struct Game_Input {
+    uint8_t keys_down;
+    uint8_t keys_pressed;
+};
+
+static_assert(Game_Key_COUNT <= 8);
+
+static inline bool game_input_is_key_down(struct Game_Input input, enum Game_Key key) {
+    return (input.keys_down & (1u << key)) != 0;
+}
+
+static inline bool game_input_is_key_pressed(struct Game_Input input, enum Game_Key key) {
+    return (input.keys_pressed & (1u << key)) != 0;
+}
+
 struct Game_Context {
     struct Allocator *scene_allocator;
     int screen_width, screen_height;
+
+    uint64_t random_seed;
+    struct Game_Input input;
 };
 
+// `update` advances the simulation by one fixed step and may run zero or several times per display frame.
+// `draw` runs once per display frame; `alpha` is how far (0..1) the frame sits between the last step and the next.
 typedef void *(*Scene_Init_Function)    (struct Game_Context *);
-typedef void  (*Scene_Update_Function)  (struct Game_Context *, void *, float);
+typedef void  (*Scene_Update_Function)  (struct Game_Context *, void *, float fixed_delta_time);
+typedef void  (*Scene_Draw_Function)    (struct Game_Context *, void *, float alpha);
 typedef void  (*Scene_Destroy_Function) (struct Game_Context *, void *);
 
 struct Scene_Functions {
     Scene_Init_Function    init;
     Scene_Update_Function  update;
+    Scene_Draw_Function    draw;
     Scene_Destroy_Function destroy;
 };
 
@@ -1,6 +1,8 @@
 #include <stddef.h>
 #include <stdio.h>
+#include <string.h>
 #include <time.h>
+#include <math.h>
 #include "raylib.h"
 
 #include "stdlib/thread_context.h"
@@ -10,10 +12,14 @@
 #include "stdlib/strings.h"
 
 #include "common.h"
+#include "replay.h"
 
 const int screen_width  = 800;
 const int screen_height = 600;
 
+const float fixed_delta_time               = 1.f / 120.f;
+const int   max_simulation_steps_per_frame = 8;
+
 static struct Scene scene_load_from_dll(
     const char *dll_path,
     const char *temp_dll_path,
@@ -23,13 +29,38 @@ static struct Scene scene_load_from_dll(
 
 static void scene_unload(struct Scene *scene);
 
-int main(void) {
+static struct Game_Input sample_input(void);
+
+static const char *usage = "Usage: game_snippets [--record <log> | --replay <log>]";
+
+int main(int argc, char **argv) {
+    // Arguments are handled before anything is set up so the error paths have nothing to release
+    struct Replay replay = { 0 };
+    uint64_t random_seed = (uint64_t) time(0);
+
+    if (argc == 3 && strcmp(argv[1], "--record") == 0) {
+        if (!replay_open_for_recording(&replay, argv[2], random_seed)) {
+            fprintf(stderr, "Failed to open replay log for recording: %s\n", argv[2]);
+            return 1;
+        }
+
+    } else if (argc == 3 && strcmp(argv[1], "--replay") == 0) {
+        if (!replay_open_for_playback(&replay, argv[2])) {
+            fprintf(stderr, "Failed to open replay log for playback: %s\n", argv[2]);
+            return 1;
+        }
+
+        random_seed = replay.seed;
+
+    } else if (argc != 1) {
+        fprintf(stderr, "%s\n", usage);
+        return 1;
+    }
+
     struct Thread_Context tctx;
     thread_context_init_and_equip(&tctx);
     struct Allocator persistent = scratch_begin();
 
-    SetRandomSeed(time(0));
-
     InitWindow(screen_width, screen_height, "raylib [core] example - basic window");
     SetTargetFPS(60);
 
@@ -37,6 +68,7 @@ int main(void) {
         .scene_allocator = &persistent,
         .screen_width    = screen_width,
         .screen_height   = screen_height,
+        .random_seed     = random_seed,
     };
 
     struct Scene current_scene_info = { 0 };
@@ -49,19 +81,42 @@ int main(void) {
     );
 
     float reload_timer = 0.0f;
+    float simulation_accumulator = 0.0f;
+    uint8_t pending_keys_pressed = 0;
 
     struct Scene_Functions *current_scene = &current_scene_info.functions;
     void *scene_data = current_scene->init(&game);
 
     while (!WindowShouldClose()) {
         float delta_time = GetFrameTime();
+        struct Game_Input input = sample_input();
+
+        static_assert(Replay_Mode_COUNT == 3);
+        if (replay.mode == Replay_Mode_Playback) {
+            if (!replay_read_frame(&replay, &delta_time, &input)) {
+                if (replay.failed) {
+                    fprintf(stderr, "Replay log is truncated or unreadable, stopped after %zu frames\n", replay.frame_count);
+                } else {
+                    fprintf(stderr, "Replay finished (%zu frames)\n", replay.frame_count);
+                }
+                break;
+            }
+
+        } else if (replay.mode == Replay_Mode_Record) {
+            if (!replay_write_frame(&replay, delta_time, input)) {
+                fprintf(stderr, "Failed to write replay log, recording stopped after %zu frames\n", replay.frame_count);
+            }
+        }
+
+        game.input = input;
+        bool hard_reload = game_input_is_key_pressed(input, Game_Key_F5);
 
         reload_timer += delta_time;
-        if ((reload_timer >= 1.0f) || IsKeyPressed(KEY_F5)) {
+        if ((reload_timer >= 1.0f) || hard_reload) {
 
             long long dll_mod_time = win32_get_file_last_modified_time("bin/typing_text.dll");
 
-            if (dll_mod_time > current_scene_info.last_library_write_time || IsKeyPressed(KEY_F5)) {
+            if (dll_mod_time > current_scene_info.last_library_write_time || hard_reload) {
                 scene_unload(&current_scene_info);
                 current_scene_info = scene_load_from_dll(
                     "bin/typing_text.dll",
@@ -72,7 +127,7 @@ int main(void) {
                 );
                 current_scene = &current_scene_info.functions;
 
-                if (IsKeyPressed(KEY_F5)) {
+                if (hard_reload) {
                     current_scene->destroy(&game, scene_data);
                     scene_data = current_scene->init(&game);
                     fprintf(stderr, "Hard reloaded!\n");
@@ -85,10 +140,38 @@ int main(void) {
             reload_timer = 0.0f;
         }
 
-        current_scene->update(&game, scene_data, delta_time);
+        // Key presses are held until a simulation step consumes them,
+        // so a frame that runs no steps doesn't drop them and a frame that runs several doesn't repeat them
+        simulation_accumulator += delta_time;
+        pending_keys_pressed   |= input.keys_pressed;
+
+        int simulation_steps = 0;
+        while (simulation_accumulator >= fixed_delta_time && simulation_steps < max_simulation_steps_per_frame) {
+            game.input = (struct Game_Input) {
+                .keys_down    = input.keys_down,
+                .keys_pressed = pending_keys_pressed,
+            };
+            pending_keys_pressed = 0;
+
+            current_scene->update(&game, scene_data, fixed_delta_time);
+            simulation_accumulator -= fixed_delta_time;
+            simulation_steps++;
+        }
+
+        // After a long hitch, drop the time we couldn't catch up on instead of spiralling
+        if (simulation_accumulator >= fixed_delta_time) {
+            simulation_accumulator = fmodf(simulation_accumulator, fixed_delta_time);
+        }
+
+        game.input = input;
+        current_scene->draw(&game, scene_data, simulation_accumulator / fixed_delta_time);
     }
 
     current_scene->destroy(&game, scene_data);
+    bool was_recording = replay.mode == Replay_Mode_Record;
+    if (!replay_close(&replay) && was_recording) {
+        fprintf(stderr, "Failed to finish writing replay log, it may be truncated\n");
+    }
 
     CloseWindow();
 
@@ -97,13 +180,32 @@ int main(void) {
     return 0;
 }
 
+static struct Game_Input sample_input(void) {
+    static const int raylib_keys[Game_Key_COUNT] = {
+        [Game_Key_Space] = KEY_SPACE,
+        [Game_Key_R]     = KEY_R,
+        [Game_Key_Tab]   = KEY_TAB,
+        [Game_Key_F5]    = KEY_F5,
+    };
+
+    struct Game_Input input = { 0 };
+    for (int key = 0; key < Game_Key_COUNT; ++key) {
+        if (IsKeyDown(raylib_keys[key]))    input.keys_down    |= (uint8_t) (1u << key);
+        if (IsKeyPressed(raylib_keys[key])) input.keys_pressed |= (uint8_t) (1u << key);
+    }
+
+    return input;
+}
+
 static void *empty_init   (struct Game_Context *) { return NULL; }
-static void  empty_update (struct Game_Context *, void  *scene_data, float delta_time) { }
+static void  empty_update (struct Game_Context *, void  *scene_data, float fixed_delta_time) { }
+static void  empty_draw   (struct Game_Context *, void  *scene_data, float alpha) { }
 static void  empty_destroy(struct Game_Context *, void *scene_data) { }
 
 const struct Scene_Functions EMPTY_SCENE_FUNCTIONS = {
     .init    = &empty_init,
     .update  = &empty_update,
+    .draw    = &empty_draw,
     .destroy = &empty_destroy,
 };
 
@@ -0,0 +1,39 @@
+#ifndef RANDOM_H
+#define RANDOM_H
+
+#include <stdint.h>
+
+// Counter-based random stream: every value is a pure function of (seed, counter),
+// so each instance owns its own sequence and no state is shared between instances.
+struct Random_Stream {
+    uint64_t seed;
+    uint64_t counter;
+};
+
+static inline uint64_t random_mix64(uint64_t x) {
+    // SplitMix64 finalizer
+    x ^= x >> 30; x *= 0xbf58476d1ce4e5b9ull;
+    x ^= x >> 27; x *= 0x94d049bb133111ebull;
+    x ^= x >> 31;
+    return x;
+}
+
+static inline struct Random_Stream random_stream_make(uint64_t seed, uint64_t stream_id) {
+    return (struct Random_Stream) {
+        .seed    = random_mix64(seed ^ random_mix64(stream_id + 0x9e3779b97f4a7c15ull)),
+        .counter = 0,
+    };
+}
+
+static inline uint64_t random_stream_next(struct Random_Stream *stream) {
+    return random_mix64(stream->seed + (stream->counter++) * 0x9e3779b97f4a7c15ull);
+}
+
+// Inclusive on both ends, like raylib's `GetRandomValue`
+static inline int random_stream_range(struct Random_Stream *stream, int min, int max) {
+    if (min > max) { int tmp = min; min = max; max = tmp; }
+    uint64_t span = (uint64_t) ((int64_t) max - (int64_t) min) + 1;
+    return (int) ((int64_t) min + (int64_t) (random_stream_next(stream) % span));
+}
+
+#endif // RANDOM_H
@@ -0,0 +1,155 @@
+#include <string.h>
+
+#include "replay.h"
+
+// The log is always little-endian regardless of the host, so values are serialized byte by byte
+static bool write_u8(FILE *file, uint8_t value) {
+    return fwrite(&value, sizeof(value), 1, file) == 1;
+}
+
+static bool write_u32(FILE *file, uint32_t value) {
+    uint8_t bytes[4];
+    for (int i = 0; i < 4; ++i) bytes[i] = (uint8_t) (value >> (8 * i));
+    return fwrite(bytes, sizeof(bytes), 1, file) == 1;
+}
+
+static bool write_u64(FILE *file, uint64_t value) {
+    uint8_t bytes[8];
+    for (int i = 0; i < 8; ++i) bytes[i] = (uint8_t) (value >> (8 * i));
+    return fwrite(bytes, sizeof(bytes), 1, file) == 1;
+}
+
+static bool write_f32(FILE *file, float value) {
+    uint32_t bits;
+    static_assert(sizeof(bits) == sizeof(value));
+    memcpy(&bits, &value, sizeof(bits));
+    return write_u32(file, bits);
+}
+
+static bool read_u8(FILE *file, uint8_t *value) {
+    return fread(value, sizeof(*value), 1, file) == 1;
+}
+
+static bool read_u32(FILE *file, uint32_t *value) {
+    uint8_t bytes[4];
+    if (fread(bytes, sizeof(bytes), 1, file) != 1) return false;
+
+    *value = 0;
+    for (int i = 0; i < 4; ++i) *value |= (uint32_t) bytes[i] << (8 * i);
+    return true;
+}
+
+static bool read_u64(FILE *file, uint64_t *value) {
+    uint8_t bytes[8];
+    if (fread(bytes, sizeof(bytes), 1, file) != 1) return false;
+
+    *value = 0;
+    for (int i = 0; i < 8; ++i) *value |= (uint64_t) bytes[i] << (8 * i);
+    return true;
+}
+
+static bool read_f32(FILE *file, float *value) {
+    uint32_t bits;
+    if (!read_u32(file, &bits)) return false;
+
+    memcpy(value, &bits, sizeof(bits));
+    return true;
+}
+
+bool replay_open_for_recording(struct Replay *replay, const char *path, uint64_t seed) {
+    memset(replay, 0, sizeof(struct Replay));
+
+    replay->file = fopen(path, "wb");
+    if (!replay->file) return false;
+
+    bool header_ok = write_u32(replay->file, REPLAY_MAGIC)
+                  && write_u32(replay->file, REPLAY_VERSION)
+                  && write_u64(replay->file, seed);
+
+    if (!header_ok) {
+        fclose(replay->file);
+        replay->file = NULL;
+        return false;
+    }
+
+    replay->mode = Replay_Mode_Record;
+    replay->seed = seed;
+    return true;
+}
+
+bool replay_open_for_playback(struct Replay *replay, const char *path) {
+    memset(replay, 0, sizeof(struct Replay));
+
+    replay->file = fopen(path, "rb");
+    if (!replay->file) return false;
+
+    uint32_t magic = 0, version = 0;
+    uint64_t seed  = 0;
+    bool header_ok = read_u32(replay->file, &magic)
+                  && read_u32(replay->file, &version)
+                  && read_u64(replay->file, &seed);
+
+    if (!header_ok || magic != REPLAY_MAGIC || version != REPLAY_VERSION) {
+        fclose(replay->file);
+        replay->file = NULL;
+        return false;
+    }
+
+    replay->mode = Replay_Mode_Playback;
+    replay->seed = seed;
+    return true;
+}
+
+bool replay_write_frame(struct Replay *replay, float delta_time, struct Game_Input input) {
+    if (replay->mode != Replay_Mode_Record) return false;
+
+    bool frame_ok = write_f32(replay->file, delta_time)
+                 && write_u8 (replay->file, input.keys_down)
+                 && write_u8 (replay->file, input.keys_pressed);
+
+    if (!frame_ok) {
+        replay->failed = true;
+        replay_close(replay);
+        return false;
+    }
+
+    replay->frame_count++;
+    return true;
+}
+
+bool replay_read_frame(struct Replay *replay, float *delta_time, struct Game_Input *input) {
+    if (replay->mode != Replay_Mode_Playback) return false;
+
+    struct Game_Input frame_input = { 0 };
+    float frame_delta_time = 0.0f;
+    long frame_start = ftell(replay->file);
+
+    bool frame_ok = read_f32(replay->file, &frame_delta_time)
+                 && read_u8 (replay->file, &frame_input.keys_down)
+                 && read_u8 (replay->file, &frame_input.keys_pressed);
+
+    if (!frame_ok) {
+        // A complete log ends exactly on a frame boundary, anything else is truncated or unreadable
+        bool at_end = !ferror(replay->file)
+                   && fseek(replay->file, 0, SEEK_END) == 0
+                   && ftell(replay->file) == frame_start;
+
+        replay->failed = !at_end;
+        return false;
+    }
+
+    *delta_time = frame_delta_time;
+    *input      = frame_input;
+    replay->frame_count++;
+    return true;
+}
+
+bool replay_close(struct Replay *replay) {
+    if (replay->file) {
+        if (fclose(replay->file) != 0) replay->failed = true;
+        replay->file = NULL;
+    }
+
+    replay->mode = Replay_Mode_None;
+    return !replay->failed;
+}
@@ -0,0 +1,43 @@
+#ifndef REPLAY_H
+#define REPLAY_H
+
+#include <stdio.h>
+#include <stdint.h>
+
+#include "common.h"
+
+// Binary log layout, all fields little-endian (floats as their IEEE 754 bits):
+//   header: magic "GSRP", u32 version, u64 seed
+//   frames: f32 delta_time, u8 keys_down, u8 keys_pressed   (repeated until EOF)
+#define REPLAY_MAGIC   0x50525347u // "GSRP"
+#define REPLAY_VERSION 1u
+
+enum Replay_Mode {
+    Replay_Mode_None,
+    Replay_Mode_Record,
+    Replay_Mode_Playback,
+    Replay_Mode_COUNT,
+};
+
+struct Replay {
+    enum Replay_Mode mode;
+    FILE *file;
+    uint64_t seed;
+    size_t frame_count;
+
+    // Set when a write fails (which also stops recording) or a log turns out truncated
+    bool failed;
+};
+
+bool replay_open_for_recording(struct Replay *replay, const char *path, uint64_t seed);
+bool replay_open_for_playback (struct Replay *replay, const char *path);
+
+// Returns false and closes the log if the frame couldn't be written
+bool replay_write_frame(struct Replay *replay, float delta_time, struct Game_Input input);
+// Returns false once the log is exhausted, `failed` tells a clean end from a truncated log
+bool replay_read_frame (struct Replay *replay, float *delta_time, struct Game_Input *input);
+
+// Returns false if anything went wrong with the log, including the final flush
+bool replay_close(struct Replay *replay);
+
+#endif // REPLAY_H
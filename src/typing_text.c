@@ -4,12 +4,14 @@
 #include "raylib.h"
 
 #include "common.h"
+#include "random.h"
 
 #include "stdlib/allocators.h"
 #include "stdlib/strings.h"
 
 void *init   (struct Game_Context *);
 void  update (struct Game_Context *, void *, float);
+void  draw   (struct Game_Context *, void *, float);
 void  destroy(struct Game_Context *, void *);
 
 extern struct Scene_Functions __declspec(dllexport) get_scene_functions(void);
@@ -17,6 +19,7 @@ struct Scene_Functions get_scene_functions(void) {
     return (struct Scene_Functions) {
         .init    = &init,
         .update  = &update,
+        .draw    = &draw,
         .destroy = &destroy,
     };
 }
@@ -48,7 +51,10 @@ struct Typing_Text {
 
     float typing_delay;
     float typing_timer;
-    float next_letter_speed_modifier;
+    // Scales `typing_delay` for the next letter, so switching to fast-forward also shortens a pending pause
+    float next_letter_speed_factor;
+
+    struct Random_Stream random;
 };
 
 static void typing_animation_process(struct Typing_Text *text, float delta_time);
@@ -71,6 +77,9 @@ struct Scene_Context {
     struct Settings settings;
     Rectangle container;
     float default_typing_delay;
+
+    // Each `Typing_Text` takes the next id so no two instances share a random sequence
+    uint64_t next_random_stream_id;
 };
 
 void *init(struct Game_Context *game) {
@@ -93,21 +102,48 @@ void *init(struct Game_Context *game) {
     self->text.source_length = TextLength(self->text.source);
     self->text.workspace = format_cstring(game->scene_allocator, "%s", self->text.source);
     self->text.typing_delay = self->default_typing_delay;
+    self->text.random = random_stream_make(game->random_seed, self->next_random_stream_id++);
 
     return self;
 }
 
 void update(
     struct Game_Context *game,
-    void *scene_context, float delta_time
+    void *scene_context, float fixed_delta_time
 ) {
     struct Scene_Context *self = (struct Scene_Context *) scene_context;
 
-    if (IsKeyPressed(KEY_R)) {
+    if (game_input_is_key_pressed(game->input, Game_Key_R)) {
         self->text.cursor = 0;
         self->text.state  = Typing_Text_Animation_State_ChooseLetter;
     }
 
+    if (game_input_is_key_pressed(game->input, Game_Key_Tab)) {
+        self->settings.text_skip_mode = self->settings.text_skip_mode == Text_Skip_Mode_FastForward
+            ? Text_Skip_Mode_JumpToEnd
+            : Text_Skip_Mode_FastForward;
+    }
+
+    self->text.typing_delay = self->default_typing_delay;
+    if (game_input_is_key_down(game->input, Game_Key_Space)) {
+        static_assert(Text_Skip_Mode_COUNT == 2);
+        if (self->settings.text_skip_mode == Text_Skip_Mode_JumpToEnd) {
+            self->text.cursor = self->text.source_length;
+
+        } else if (self->settings.text_skip_mode == Text_Skip_Mode_FastForward) {
+            self->text.typing_delay /= 5.f;
+        }
+    }
+
+    typing_animation_process(&self->text, fixed_delta_time);
+}
+
+void draw(
+    struct Game_Context *game,
+    void *scene_context, float alpha
+) {
+    struct Scene_Context *self = (struct Scene_Context *) scene_context;
+
     BeginDrawing(); {
 
         ClearBackground(RAYWHITE);
@@ -127,8 +163,6 @@ void update(
             GRAY
         );
 
-        typing_animation_process(&self->text, delta_time);
-
         float space_bar_width  = game->screen_width / 3.f;
         float space_bar_height = 50;
         float space_bar_x = (game->screen_width / 2.f) - (space_bar_width / 2.f);
@@ -139,7 +173,7 @@ void update(
             space_bar_width, space_bar_height
         }, 3, MAROON);
 
-        if (IsKeyDown(KEY_SPACE)) {
+        if (game_input_is_key_down(game->input, Game_Key_Space)) {
             DrawRectangleRec((Rectangle) {
                 space_bar_x, space_bar_y + 5,
                 space_bar_width, space_bar_height
@@ -162,17 +196,6 @@ void update(
             }, 3, MAROON);
         }
 
-        self->text.typing_delay = self->default_typing_delay;
-        if (IsKeyDown(KEY_SPACE)) {
-            static_assert(Text_Skip_Mode_COUNT == 2);
-            if (self->settings.text_skip_mode == Text_Skip_Mode_JumpToEnd) {
-                self->text.cursor = self->text.source_length;
-
-            } else if (self->settings.text_skip_mode == Text_Skip_Mode_FastForward) {
-                self->text.typing_delay /= 5.f;
-            }
-        }
-
         const char *mode_text = "<mode_text>";
         int mode_text_width = 0;
         static_assert(Text_Skip_Mode_COUNT == 2);
@@ -189,13 +212,6 @@ void update(
             20.f, GRAY
         );
 
-
-        if (IsKeyPressed(KEY_TAB)) {
-            self->settings.text_skip_mode = self->settings.text_skip_mode == Text_Skip_Mode_FastForward
-                ? Text_Skip_Mode_JumpToEnd
-                : Text_Skip_Mode_FastForward;
-        }
-
     } EndDrawing();
 }
 
@@ -207,48 +223,51 @@ static void typing_animation_process(struct Typing_Text *text, float delta_time)
         return;
     }
 
-    bool should_type = text->typing_timer >= text->typing_delay + text->next_letter_speed_modifier;
-    if (should_type) {
-        text->typing_timer = 0;
-        text->had_typo = false;
-    }
+    text->typing_timer += delta_time;
 
-    if (should_type && text->state == Typing_Text_Animation_State_ChooseLetter) {
-        text->correct_letter = text->source[text->cursor++];
-        text->next_letter_speed_modifier = GetRandomValue(-1, 1) * (text->typing_delay * 0.6f);
+    // Emit every letter that came due during this step and carry the leftover time,
+    // so the typing rate doesn't depend on the step size
+    while (text->state != Typing_Text_Animation_State_Finished) {
+        float letter_delay = text->typing_delay * (1.0f + text->next_letter_speed_factor);
+        if (text->typing_timer < letter_delay) break;
 
-        int typo_distance = 0;
-        bool is_typo = false;
-        if (!text->had_typo) {
-            typo_distance = GetRandomValue(0, 5);
-            is_typo       = GetRandomValue(0, 30) == 0;
-        }
+        text->typing_timer -= letter_delay;
+        text->had_typo = false;
 
-        char chosen_letter = text->correct_letter;
-        if (is_typo) {
-            chosen_letter += typo_distance;
-            text->next_letter_speed_modifier = text->typing_delay * 3.0f;
-            text->state = Typing_Text_Animation_State_DeleteTypo;
-        }
+        if (text->state == Typing_Text_Animation_State_ChooseLetter) {
+            text->correct_letter = text->source[text->cursor++];
+            text->next_letter_speed_factor = random_stream_range(&text->random, -1, 1) * 0.6f;
 
-        if (text->cursor >= text->source_length) {
-            text->state = Typing_Text_Animation_State_Finished;
-        }
+            int typo_distance = 0;
+            bool is_typo = false;
+            if (!text->had_typo) {
+                typo_distance = random_stream_range(&text->random, 0, 5);
+                is_typo       = random_stream_range(&text->random, 0, 30) == 0;
+            }
+
+            char chosen_letter = text->correct_letter;
+            if (is_typo) {
+                chosen_letter += typo_distance;
+                text->next_letter_speed_factor = 3.0f;
+                text->state = Typing_Text_Animation_State_DeleteTypo;
+            }
 
-    } else if (should_type && text->state == Typing_Text_Animation_State_DeleteTypo) {
-        text->cursor--;
-        text->next_letter_speed_modifier = text->typing_delay * 2.0f;
-        text->state = Typing_Text_Animation_State_FixTypo;
+            if (text->cursor >= text->source_length) {
+                text->state = Typing_Text_Animation_State_Finished;
+            }
 
-    } else if (should_type && text->state == Typing_Text_Animation_State_FixTypo) {
-        text->workspace[text->cursor] = text->correct_letter;
-        text->cursor++;
-        text->state = Typing_Text_Animation_State_ChooseLetter;
-        text->had_typo = true;
+        } else if (text->state == Typing_Text_Animation_State_DeleteTypo) {
+            text->cursor--;
+            text->next_letter_speed_factor = 2.0f;
+            text->state = Typing_Text_Animation_State_FixTypo;
 
+        } else if (text->state == Typing_Text_Animation_State_FixTypo) {
+            text->workspace[text->cursor] = text->correct_letter;
+            text->cursor++;
+            text->state = Typing_Text_Animation_State_ChooseLetter;
+            text->had_typo = true;
+        }
     }
-
-    text->typing_timer += delta_time;
 }
 
 // Draw text using font inside rectangle limits